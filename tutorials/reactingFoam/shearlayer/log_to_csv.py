@@ -0,0 +1,57 @@
+# Convert the binary cpu_solve.bin logs written with logFormat binary to CSV.
+#
+# Usage: python log_to_csv.py [files...]
+# Without arguments, all processor*/loadBal/cpu_solve.bin files are converted
+# next to the binary files.
+
+import glob
+import struct
+import sys
+
+
+def read_log(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'DLBLOG01':
+        raise ValueError(path + ' is not a DLBFoam binary log')
+
+    pos = 8
+    version, rank, n_specie, n_reaction, n_columns = struct.unpack_from('=5i', data, pos)
+    pos += 20
+
+    columns = []
+    for _ in range(n_columns):
+        (length,) = struct.unpack_from('=i', data, pos)
+        pos += 4
+        columns.append(data[pos:pos + length].decode())
+        pos += length
+
+    # each block stores the values column by column
+    values = []
+    while pos < len(data):
+        (n_rows,) = struct.unpack_from('=i', data, pos)
+        pos += 4
+        block = struct.unpack_from('=%dd' % (n_rows * n_columns), data, pos)
+        pos += 8 * n_rows * n_columns
+        for r in range(n_rows):
+            values.append([block[c * n_rows + r] for c in range(n_columns)])
+    header = {'version': version, 'rank': rank, 'nSpecie': n_specie, 'nReaction': n_reaction}
+    return header, columns, values
+
+
+def write_csv(path, header, columns, values):
+    with open(path, 'w') as f:
+        f.write('# rank %(rank)d, nSpecie %(nSpecie)d, nReaction %(nReaction)d\n' % header)
+        f.write(','.join(columns + ['rank']) + '\n')
+        for row in values:
+            f.write(','.join(repr(float(v)) for v in row) + ',%d\n' % header['rank'])
+
+
+if __name__ == '__main__':
+    files = sys.argv[1:] or sorted(glob.glob('processor*/loadBal/cpu_solve.bin'))
+    for path in files:
+        header, columns, values = read_log(path)
+        out = path[:-len('.bin')] + '.csv'
+        write_csv(out, header, columns, values)
+        print('%s -> %s (%d rows)' % (path, out, len(values)))
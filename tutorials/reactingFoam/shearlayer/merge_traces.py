@@ -0,0 +1,38 @@
+# Merge the trace.json timelines written with trace by each rank into a
+# single trace-event file, which can be loaded into chrome://tracing or
+# https://ui.perfetto.dev.
+#
+# Usage: python merge_traces.py [output] [files...]
+# Without file arguments, all processor*/loadBal/trace.json files are merged.
+# The default output is trace.json.
+
+import glob
+import json
+import sys
+
+
+def read_trace(path):
+    with open(path) as f:
+        text = f.read().rstrip()
+
+    # the closing bracket is missing if the run was interrupted
+    if not text.endswith(']'):
+        text = text.rstrip(',') + ']'
+    return json.loads(text)
+
+
+def main():
+    output = sys.argv[1] if len(sys.argv) > 1 else 'trace.json'
+    paths = sys.argv[2:] or sorted(glob.glob('processor*/loadBal/trace.json'))
+
+    events = []
+    for path in paths:
+        events.extend(read_trace(path))
+
+    with open(output, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, f)
+    print('Merged %d events of %d ranks into %s' % (len(events), len(paths), output))
+
+
+if __name__ == '__main__':
+    main()